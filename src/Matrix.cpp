@@ -1,4 +1,4 @@
-#include <algorithm>	//used std::max
+#include <algorithm>	//used std::max and std::swap_ranges
 #include <ostream>		//used std::ostream
 #include <stdexcept>	//used std::invalid_arguments errors
 #include <utility>		//used std::pair and std::swap
@@ -58,6 +58,52 @@ Copy constructor. Makes a deep copy of the input matrix.
 Matrix::Matrix (const Matrix &matrix) : _matrix(matrix._matrix), _rows(matrix.rows()), _columns(matrix.columns()){
 } //Note that, since _matrix is a vector<double>, matrix is doing a deep copy.
 
+/*
+Move constructor. Steals the storage of the input matrix instead of copying it.
+The moved-from matrix is left empty.
+*/
+Matrix::Matrix (Matrix &&matrix) noexcept : _matrix(std::move(matrix._matrix)), _rows(matrix._rows), _columns(matrix._columns) {
+	matrix._matrix.clear();
+	matrix._rows = 0;
+	matrix._columns = 0;
+}
+
+/*
+Copy assignment. Makes a deep copy of the input matrix, reusing the current storage
+when it is large enough.
+*/
+Matrix& Matrix::operator= (const Matrix &matrix) {
+	_matrix = matrix._matrix;	//vector's copy assignment only reallocates if the capacity is too small.
+	_rows = matrix._rows;
+	_columns = matrix._columns;
+	return *this;
+}
+
+/*
+Move assignment. Steals the storage of the input matrix instead of copying it.
+*/
+Matrix& Matrix::operator= (Matrix &&matrix) noexcept {
+	if (this != &matrix) {
+		_matrix = std::move(matrix._matrix);
+		_rows = matrix._rows;
+		_columns = matrix._columns;
+		matrix._matrix.clear();
+		matrix._rows = 0;
+		matrix._columns = 0;
+	}
+	return *this;
+}
+
+/*
+Exchanges the contents of *this and other in constant time. No entries are copied.
+*/
+void Matrix::swap (Matrix &other) noexcept {
+	using std::swap;
+	swap(_matrix, other._matrix);
+	swap(_rows, other._rows);
+	swap(_columns, other._columns);
+}
+
 /*
 Overloads () to access an element [i,j] of the matrix.
 */
@@ -66,7 +112,7 @@ const double& Matrix::operator() (std::vector<double>::size_type i,
 	return _matrix[i * static_cast<std::vector<double>::size_type>(_columns) + j];
 }
 double& Matrix::operator() (std::vector<double>::size_type i, std::vector<double>::size_type j) {
-	return const_cast<double&>((*(const_cast<Matrix* const>(this)))(i, j));
+	return const_cast<double&>((*(const_cast<const Matrix*>(this)))(i, j));
 }
 
 /*
@@ -76,38 +122,42 @@ If the matrix is empty, throws an invalid_argument error.
 If the dimension of the vector is different from the number of columns of the matrix,
 it throws an invalid_argument error.
 */
-std::vector<double> Matrix::operator* (std::vector<double> &vector){
+std::vector<double> Matrix::operator* (const std::vector<double> &vector) const {
+	std::vector<double> ret;
+	this->multiply_into(vector, ret);
+	return ret;
+}
+
+/*
+Multiplies the matrix on the right by vector and writes the result into out, which is
+resized to the number of rows of the matrix. No allocation happens if out already has
+enough capacity. out must not be the same object as vector.
+Throws the same errors as operator*.
+*/
+void Matrix::multiply_into (const std::vector<double> &vector, std::vector<double> &out) const {
 	if ( this->empty() )
 		throw std::invalid_argument("Matrix: the matrix must be non-empty.");
 
 	if ( vector.size() != static_cast<std::vector<double>::size_type>(this->columns() ))
 		throw std::invalid_argument("Matrix: the dimension of the vector must be the equal to the number of columns of the matrix.");
 
-	//output vector which we will grow in a loop
-	std::vector<double> ret;
-	ret.reserve( static_cast<std::vector<double>::size_type>(this->rows()) );
+	out.resize( static_cast<std::vector<double>::size_type>(this->rows()) );
 
-	//vector and row iterators
-	std::vector<double>::const_iterator vec_iter;
-	const_iterator row_iter, row_end;
+	// Number of rows and columns are calculated beforehand to avoid calling in the loop check.
+	const size_t number_of_rows = this->rows();
+	const size_t number_of_columns = this->columns();
 
-	// Number of rows is calculated beforehand to avoid calling in the loop check.
-	auto number_of_rows = this->rows();
+	// Raw pointers let the compiler vectorize the inner loop.
+	const double *row = _matrix.data();
+	const double *vec = vector.data();
 
-	for (size_t i{ 0 }; i != number_of_rows; ++i) {
-		vec_iter = std::begin(vector);
-		row_iter = this->row_cbegin(i);
-		row_end = this->row_cend(i);
+	for (size_t i{ 0 }; i != number_of_rows; ++i, row += number_of_columns) {
 		double sum{ 0.0 };
-		//it is not necessary to check vec_iter because we are guaranteed that
-		//row_iter and vec_iter will iterate over the same number of elements 
-		for (; row_iter != row_end; ++row_iter, ++vec_iter) {
-			sum += (*row_iter)*(*vec_iter);
+		for (size_t j{ 0 }; j != number_of_columns; ++j) {
+			sum += row[j] * vec[j];
 		}
-		ret.push_back(sum);
+		out[i] = sum;
 	}
-
-	return ret;
 }
 
 //elementary row operations
@@ -115,7 +165,7 @@ std::vector<double> Matrix::operator* (std::vector<double> &vector){
 Exchanges the rows row1 and row2.
 Returns invalid_argument error if one of them does not exists, or *this if successful.
 */
-Matrix Matrix::exchangeRows (std::vector<double>::size_type row1, std::vector<double>::size_type row2) {
+Matrix& Matrix::exchangeRows (std::vector<double>::size_type row1, std::vector<double>::size_type row2) {
 	if ( std::max(row1, row2) >= static_cast<std::vector<double>::size_type>(this->rows()) ) 
 		//we used >= because row starts counting at zero.
 		throw std::invalid_argument("Matrix: both rows must be smaller than the matrix's dimensions.");
@@ -123,10 +173,8 @@ Matrix Matrix::exchangeRows (std::vector<double>::size_type row1, std::vector<do
 	if (row1 == row2)
 		return *this; //saves time when the rows are the same.
 
-	//reads the rows from beginning to end and exchange the entries between themselves.
-	for (iterator itr1 = this->row_begin(row1), itr2 = this->row_begin(row2); itr1 != this->row_end(row1); ++itr1, ++itr2){
-		std::swap(*itr1, *itr2);
-	}
+	//exchanges the entries of both rows in a single pass that the compiler can vectorize.
+	std::swap_ranges(this->row_begin(row1), this->row_end(row1), this->row_begin(row2));
 	return *this;
 }
 
@@ -135,13 +183,15 @@ Matrix Matrix::exchangeRows (std::vector<double>::size_type row1, std::vector<do
 Multiplies a row by a double.
 Returns invalid_argument error if row does not exists, or *this if successful.
 */
-Matrix Matrix::multiplyRow(std::vector<double>::size_type row, double scalar){
+Matrix& Matrix::multiplyRow(std::vector<double>::size_type row, double scalar){
 	if ( row >= static_cast<std::vector<double>::size_type>(this->rows()) )
 		//we used >= because row starts counting at zero.
 		throw std::invalid_argument("Matrix: row must exist.");
 
-	for (iterator itr = this->row_begin(row); itr != this->row_end(row); ++itr){
-		*itr *= scalar;
+	double *entry = &(*this)(row, 0);
+	const size_t number_of_columns = this->columns();
+	for (size_t j = 0; j != number_of_columns; ++j){
+		entry[j] *= scalar;
 	}
 	return *this;
 }
@@ -150,7 +200,7 @@ Matrix Matrix::multiplyRow(std::vector<double>::size_type row, double scalar){
 Sums (scalar * row1) to row2. It doesn't change the values at row1.
 Returns invalid_argument error if one of the rows doesn't exist, or *this if successful.
 */
-Matrix Matrix::linearCombination(double scalar, std::vector<double>::size_type row1, std::vector<double>::size_type row2){
+Matrix& Matrix::linearCombination(double scalar, std::vector<double>::size_type row1, std::vector<double>::size_type row2){
 	if ( std::max(row1, row2) >= static_cast<std::vector<double>::size_type>(this->rows()) )
 		//we used >= because row starts counting at zero.
 		throw std::invalid_argument("Matrix: both rows must exist.");
@@ -163,8 +213,13 @@ Matrix Matrix::linearCombination(double scalar, std::vector<double>::size_type r
 		return this->multiplyRow(row2, scalar + 1.0);
 	}
 	
-	for (iterator itr1 = this->row_begin(row1), itr2 = this->row_end(row2); itr1 != row_end(row1); ++itr1, ++itr2){
-		*itr2 += scalar * (*itr1);
+	// axpy: row2 += scalar * row1. The rows are distinct, so the pointers never alias
+	// and the compiler can vectorize the loop.
+	const double *source = &(*this)(row1, 0);
+	double *target = &(*this)(row2, 0);
+	const size_t number_of_columns = this->columns();
+	for (size_t j = 0; j != number_of_columns; ++j){
+		target[j] += scalar * source[j];
 	}
 	return *this;
 }
@@ -173,6 +228,7 @@ Matrix Matrix::linearCombination(double scalar, std::vector<double>::size_type r
 /*
 Multiplies a scalar by a matrix on the right.
 Throws invalid_argument error if the matrix is empty.
+Pass an rvalue to scale the matrix in place without copying it.
 */
 Matrix operator* (double scalar, Matrix matrix) {
 
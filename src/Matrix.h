@@ -41,8 +41,25 @@ public:
 	Copy constructor. Makes a deep copy of the input matrix.
 	*/
 	Matrix (const Matrix&);
+
+	/*
+	Move constructor. Steals the storage of the input matrix instead of copying it.
+	The moved-from matrix is left empty.
+	*/
+	Matrix (Matrix&&) noexcept;
 	//end of constructors
 
+	/*
+	Copy assignment. Makes a deep copy of the input matrix, reusing the current storage
+	when it is large enough.
+	*/
+	Matrix& operator= (const Matrix&);
+
+	/*
+	Move assignment. Steals the storage of the input matrix instead of copying it.
+	*/
+	Matrix& operator= (Matrix&&) noexcept;
+
 	/*
 	Overloads () to access an element [i,j] of the matrix. Start counting at 0.
 	It is inlined to optimize performance.
@@ -56,7 +73,15 @@ public:
 	If the dimension of the vector is different from the number of columns of the matrix,
 	then it throws a ValueError.
 	*/
-	std::vector<double> operator* (std::vector<double>&);
+	std::vector<double> operator* (const std::vector<double>&) const;
+
+	/*
+	Multiplies the matrix on the right by vector and writes the result into out, which is
+	resized to the number of rows of the matrix. No allocation happens if out already has
+	enough capacity. out must not be the same object as vector.
+	Throws the same errors as operator*.
+	*/
+	void multiply_into (const std::vector<double>&, std::vector<double>&) const;
 
 	/*
 	Returns the number of rows of the matrix.
@@ -166,25 +191,33 @@ public:
 
 
 	//elementary row operations
+	/*
+	The operations below work in place and return a reference to *this, so they can be chained
+	(e.g.: A.exchangeRows(0, 1).multiplyRow(0, 2.0)) without copying the matrix.
+	*/
+
 	/*
 	Exchanges the rows row1 and row2.
 	Returns invalid_argument error if one of them does not exist, or *this if successful.
 	*/
-	Matrix exchangeRows (std::vector<double>::size_type, std::vector<double>::size_type);
+	Matrix& exchangeRows (std::vector<double>::size_type, std::vector<double>::size_type);
 
 	/*
 	Multiplies a row by a double.
 	Returns invalid_argument error if row does not exists, or *this if successful.
 	*/
-	Matrix multiplyRow(std::vector<double>::size_type, double);
+	Matrix& multiplyRow(std::vector<double>::size_type, double);
 
 	/*
 	Sums (scalar * row1) to row2. It doesn't change the values at row1.
 	Returns invalid_argument error if one of the rows doesn't exist, or *this if successful.
 	*/
-	Matrix linearCombination(double, std::vector<double>::size_type, std::vector<double>::size_type);
-	
-	// TODO: implement a swap function
+	Matrix& linearCombination(double, std::vector<double>::size_type, std::vector<double>::size_type);
+
+	/*
+	Exchanges the contents of *this and other in constant time. No entries are copied.
+	*/
+	void swap (Matrix&) noexcept;
 
 private:
 	/*
@@ -203,6 +236,21 @@ private:
 	// matrix as argument and finds out the number of digits of the largest entry.
 };
 
+/*
+Exchanges the contents of two matrices in constant time. Lets std::swap and algorithms
+pick up Matrix::swap through argument-dependent lookup.
+*/
+inline void swap (Matrix& lhs, Matrix& rhs) noexcept {
+	lhs.swap(rhs);
+}
+
+/*
+Multiplies a scalar by a matrix on the right.
+Throws invalid_argument error if the matrix is empty.
+Pass an rvalue to scale the matrix in place without copying it.
+*/
+Matrix operator* (double, Matrix);
+
 /*
 Overloads << so we can print a matrix.
 */
@@ -1,9 +1,107 @@
+#include <algorithm>	//used std::fill
 #include <cfloat>		//used std::DBL_EPSILON
+#include <cmath>		//used std::abs
 #include <stdexcept>	//used std::invalid_argument
-#include <utility>		//used std::pair and std::make_pair
+#include <utility>		//used std::pair, std::make_pair and std::move
+#include <vector>		//used std::vector
 #include "decomposition.h"
 #include "matrix.h"
 
+
+namespace {
+	/*
+	Auxiliary function that checks whether A can be handed to the LU decomposition.
+	Throws an invalid_argument if at least one of the matrix dimensions is zero or if A isn't square.
+	*/
+	static void check_decomposable(const Matrix& A){
+		if (!A.rows() || !A.columns())
+			throw std::invalid_argument("lu_decomp: the matrix must have positive dimensions.");
+		if (A.rows() != A.columns())
+			throw std::invalid_argument("lu_decomp: the matrix must be square.");
+	}
+
+	/*
+	Auxiliary function that checks the arguments of lu_decomp_into.
+	Throws an invalid_argument if A cannot be decomposed, if L or U have the wrong dimensions
+	or if any two of A, L and U are the same object.
+	*/
+	static void check_decomposable_into(const Matrix& A, const Matrix& L, const Matrix& U){
+		check_decomposable(A);
+		if (&L == &U || &L == &A || &U == &A)
+			throw std::invalid_argument("lu_decomp: A, L and U must be different matrices.");
+		if (L.rows() != A.rows() || L.columns() != A.columns() || U.rows() != A.rows() || U.columns() != A.columns())
+			throw std::invalid_argument("lu_decomp: L and U must have the same dimensions as A.");
+	}
+
+	/*
+	Auxiliary function with the decomposition itself (Doolittle's algorithm with partial pivoting).
+	Expects the arguments to have been checked by check_decomposable_into.
+	If pivots is not null, it must have one entry per row of A and receives the row exchanges.
+	Throws domain_error if the matrix cannot be decomposed in LU.
+	*/
+	static void decompose(Matrix& A, Matrix& L, Matrix& U, std::vector<size_t>* pivots){
+		const size_t dimension = A.rows();
+		// The diagonal of L is set to 1.0 column by column in the loop below. Setting it beforehand would
+		// let the row exchanges move those 1.0 entries above the diagonal.
+		std::fill(L.begin(), L.end(), 0.0);
+		std::fill(U.begin(), U.end(), 0.0);
+
+		// Variables used in the loop below. They are defined outside the loop to avoid creating and
+		// destroying them at every iteration.
+		// i will be the looping variable used in the inner loops.
+		// k will be an index used in the matrix multiplications inside the inner loops.
+		// max_index will hold the index of the row with the current greatest reduced entry in column j
+		//(as long as it is greater than j).
+		// max_entry will be the absolute value of that entry.
+		size_t i, k, max_index;
+		double max_entry;
+
+		for (size_t j = 0; j < dimension; ++j){
+			for (i = 0; i < j; ++i){	//these two nested loops are performing U(i,j) = A(i,j) - \sum_{k=0}^{i-1} L(i,k)U(k,j)
+				double *entry = &U(i, j);
+				*entry = A(i, j);
+				for (k = 0; k < i; ++k){
+					*entry -= L(i, k) * U(k, j);
+				}
+			}
+
+			// Computes the reduced column A(i,j) - \sum_{k=0}^{j-1} L(i,k)U(k,j) for the rows i >= j.
+			// It is kept in L(i,j), which is still zero, so that it follows the row exchange below.
+			max_index = j;
+			max_entry = 0.0;
+			for (i = j; i < dimension; ++i){
+				double *entry = &L(i, j);
+				*entry = A(i, j);
+				for (k = 0; k < j; ++k){
+					*entry -= L(i, k) * U(k, j);
+				}
+				if (max_entry < std::abs(*entry)){
+					max_entry = std::abs(*entry);
+					max_index = i;
+				}
+			}
+			if (max_entry < DBL_EPSILON)
+				throw std::domain_error("lu_decomp: A cannot be decomposed into LU. The matrix is singular or its entries are too small.");
+
+			//we pivot matrix A, that is, exchange the current row j
+			//with the row i>j that has the greatest reduced entry in column j
+			A.exchangeRows(max_index, j);
+			L.exchangeRows(max_index, j);
+			if (pivots)
+				(*pivots)[j] = max_index;
+
+			U(j, j) = L(j, j);
+			L(j, j) = 1.0;
+			// let's define the variable quotient below so that U(j, j) is not calculated in every iteration of the loop below.
+			double quocient = U(j, j); // it is never zero, since it is the pivot checked against DBL_EPSILON above.
+			for (i = j + 1; i < dimension; ++i){
+				L(i, j) /= quocient;
+			}
+		}
+	}
+} // namespace
+
+
 /*
 Decomposes matrix A into A = LU where L is lower triangular and U is upper triangular.
 Returns a std::pair<Matrix,Matrix> = pair(L,U)
@@ -13,66 +111,35 @@ Throws domain_error if the matrix cannot be decomposed in LU.
 Still a simple implementation.
 */
 std::pair<Matrix, Matrix> lu_decomp(Matrix& A){
-	if (!A.rows() || !A.columns())
-		throw std::invalid_argument("lu_decomp: the matrix must have positive dimensions.");
-	if (A.rows() != A.columns())
-		throw std::invalid_argument("lu_decomp: the matrix must be square.");
+	check_decomposable(A);	//checked before allocating L and U, whose constructor rejects zero dimensions.
 
-	const size_t dimension = A.rows();
 	Matrix L(A.rows(), A.columns(), 0.0);
-	for (size_t i = 0; i < dimension; ++i) {
-		L(i, i) = 1.0;
-	}
 	Matrix U(A.rows(), A.columns(), 0.0);
+	lu_decomp_into(A, L, U);
+	return std::make_pair(std::move(L), std::move(U));	//moves, so L and U are not copied into the pair.
+}
 
-	// Variables used in the loop below. They are defined outside the loop to avoid creating and
-	// destroying them at every iteration.
-	// i will be the looping variable used in the inner loops.
-	// k will be an index used in a matrix multiplication inside the second inner the loop
-	// max_index will hold the index of the row with the current greatest entry in column j
-	//(as long as it is greater than j).
-	// max_entry will be the largest entry in the column j.
-	size_t i, k, max_index;
-	double max_entry;
-
-	for (size_t j = 0; j < dimension; ++j){
-		//we want to pivot matrix A, that is, exchange the current row j
-		//with the row k>j that has the greatest entry in column j
-		max_index = j;
-		max_entry = A(j, j);
-		for (k = j + 1; k < dimension; ++k){
-			if (max_entry < A(k, j)){
-				max_entry = A(k, j);
-				max_index = k;
-			}
-		}
-		if (abs(max_entry) < DBL_EPSILON)
-			throw std::domain_error("lu_decomp: A cannot be decomposed into LU. The matrix is not diagonizable or its entries are too small.");
-
-		A.exchangeRows(max_index, j);
-		L.exchangeRows(max_index, j);
-
-		U(0, j) = A(0, j);	//U(0,j) = A(0,j), always!
-		for (i = 1; i <= j; ++i){	//these two nested loops are performing U(i,j) = A(i,j) - \sum_{k=0}^{j-1} L(j,k)U(k,j)
-			double *entry = &U(i, j);
-			*entry = A(i, j);
-			for (k = 0; k <= j - 1; ++k){
-				*entry -= L(i, k) * U(k, j);
-			}
-		}
+/*
+Same as lu_decomp, but writes L and U into caller-provided matrices instead of allocating them.
+L and U must have the same dimensions as A; their previous contents are overwritten.
+A, L and U must be three different objects.
+Throws the same errors as lu_decomp, and also an invalid_argument if L or U have the wrong dimensions
+or if any two of A, L and U are the same object.
+*/
+void lu_decomp_into(Matrix& A, Matrix& L, Matrix& U){
+	check_decomposable_into(A, L, U);
+	decompose(A, L, U, nullptr);
+}
 
-		L(j, j) = 1.0;
-		// let's define the variable quotient below so that U(j, j) is not calculated in every iteration of the loop below.
-		double quocient = U(j, j); // it is never zero because U(j,j) = A(j,j) which is non-zero (otherwise would have thrown above).
-		for (i = j + 1; i < dimension; ++i){	//this continues from where the other loop left off
-			double *entry = &L(i, j);
-			*entry = A(i, j);
-			for (k = 0; k <= j - 1; ++k){
-				*entry -= L(i, k) * U(k, j);
-			}
-			*entry = *entry / quocient;
-		}
-	}
-	return std::make_pair(L, U);
-	//TODO: correct mistakes in algorithm.
-}
\ No newline at end of file
+/*
+Same as lu_decomp_into, but also records the row exchanges in pivots: at step j, row j was exchanged
+with row pivots[j] (pivots[j] >= j). Applying these exchanges in order to a vector b permutates it the
+same way as the rows of A. pivots is resized to the dimension of A; no allocation happens if it already
+has enough capacity.
+Throws the same errors as lu_decomp_into.
+*/
+void lu_decomp_into(Matrix& A, Matrix& L, Matrix& U, std::vector<size_t>& pivots){
+	check_decomposable_into(A, L, U);
+	pivots.resize(A.rows());
+	decompose(A, L, U, &pivots);
+}
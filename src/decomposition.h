@@ -2,6 +2,7 @@
 #define GUARD_decomposition_h
 
 #include <utility>		//used std::pair
+#include <vector>		//used std::vector
 #include "matrix.h"
 
 //TODO: learn about matrix conditioning and matrix preconditioning
@@ -15,6 +16,25 @@ Throws domain_error if the matrix cannot be decomposed in LU.
 Still a simple implementation.
 */
 std::pair<Matrix, Matrix> lu_decomp(Matrix& A);
+
+/*
+Same as lu_decomp, but writes L and U into caller-provided matrices instead of allocating them.
+L and U must have the same dimensions as A; their previous contents are overwritten.
+A, L and U must be three different objects.
+Useful when decomposing many matrices of the same size, since the buffers can be reused.
+Throws the same errors as lu_decomp, and also an invalid_argument if L or U have the wrong dimensions
+or if any two of A, L and U are the same object.
+*/
+void lu_decomp_into(Matrix& A, Matrix& L, Matrix& U);
+
+/*
+Same as lu_decomp_into, but also records the row exchanges in pivots: at step j, row j was exchanged
+with row pivots[j] (pivots[j] >= j). Applying these exchanges in order to a vector b permutates it the
+same way as the rows of A. pivots is resized to the dimension of A; no allocation happens if it already
+has enough capacity.
+Throws the same errors as lu_decomp_into.
+*/
+void lu_decomp_into(Matrix& A, Matrix& L, Matrix& U, std::vector<size_t>& pivots);
 //TODO: maybe create a extra parameter in the above function indicating if we can mess with A.
 // If not, then we should copy the matrix before messing with it.
 
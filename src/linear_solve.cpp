@@ -1,5 +1,6 @@
 #include <stdexcept>    //used std::invalid_argument
 #include <tuple>      //used std::tie
+#include <utility>    //used std::swap
 #include <vector>
 #include "decomposition.h"
 #include "linear_solve.h"
@@ -9,38 +10,50 @@
 namespace {
     /*
     Auxiliary function to solve linear systems when the coefficient matrix is lower-triangular.
+    Writes the solution into y, which must already have the same length as b. y may be the same object as b.
     */
-    static std::vector<double> linear_solve_lower(const Matrix& L, const std::vector<double> b){
+    static void linear_solve_lower(const Matrix& L, const std::vector<double>& b, std::vector<double>& y){
         const size_t length = b.size();
-        std::vector<double> y(length);
         // The values of y are calculated from top to bottom.
         // The variables row_index and column_index are the indices from the matrix' point of view.
         for (long row_index = 0; row_index < static_cast<long>(length); ++row_index) {
-            y[row_index] = b[row_index];
+            double entry = b[row_index];
             for (long column_index = 0; column_index < row_index; ++column_index){
-                y[row_index] -= L(row_index, column_index) * y[column_index];
+                entry -= L(row_index, column_index) * y[column_index];
             }
-            y[row_index] /= L(row_index, row_index); // TODO: should have a special throw for zero division?
+            y[row_index] = entry / L(row_index, row_index); // TODO: should have a special throw for zero division?
         }
-        return y;
     }
 
     /*
     Auxiliary function to solve linear systems when the coefficient matrix is upper-triangular.
+    Writes the solution into x, which must already have the same length as b. x may be the same object as b.
     */
-    static std::vector<double> linear_solve_upper(const Matrix& U, const std::vector<double> b){
+    static void linear_solve_upper(const Matrix& U, const std::vector<double>& b, std::vector<double>& x){
         const size_t length = b.size();
-        std::vector<double> x(length);
         // The values of x are calculated from bottom to top.
         // The variables row_index and column_index are the indices from the matrix' point of view.
         for (long row_index = static_cast<long>(length) - 1; row_index >= 0; --row_index) {
-            x[row_index] = b[row_index];
+            double entry = b[row_index];
             for (long column_index = static_cast<long>(length) - 1; column_index > row_index; --column_index){
-                x[row_index] -= U(row_index, column_index) * x[column_index];
+                entry -= U(row_index, column_index) * x[column_index];
             }
-            x[row_index] /= U(row_index, row_index); // TODO: should have a special throw for zero division?
+            x[row_index] = entry / U(row_index, row_index); // TODO: should have a special throw for zero division?
+        }
+    }
+
+    /*
+    Auxiliary function that checks whether Ax = b can be handed to the LU decomposition.
+    Throws std::invalid_argument if the number of rows of A is different from the length of b, or if the
+    system is empty or under or overdetermined.
+    */
+    static void check_solvable(const Matrix& A, const std::vector<double>& b){
+        if (A.rows() != b.size()){
+            throw std::invalid_argument("linear_solve: the matrix' number of rows must be equal to the length of the vector.");
+        }
+        if (!A.rows() || A.rows() != A.columns()){
+            throw std::invalid_argument("linear_solve: the system is over- or underdetermined, or is empty.");
         }
-        return x;
     }
 } // namespace
 
@@ -49,24 +62,49 @@ namespace {
 
 
 /*
-Solves a linear system Ax = b by decomposing A = LU, then solving Ly = b, followed by Ux = y.
-Returns b.
+Solves a linear system Ax = b by decomposing PA = LU, then solving Ly = Pb, followed by Ux = y.
+Returns x.
 Throws std::invalid_argument if the number of rows of A is different from the length of b, if the system
 is empty or under or overdetermined.
 Throws std::domain_error if the system is unsolvable.
 */
-std::vector<double> linear_solve(Matrix& A, const std::vector<double> b){
-    if (A.rows() != b.size()){
-        throw std::invalid_argument("linear_solve: the matrix' number of rows must be equal to the length of the vector.");
-    }
+std::vector<double> linear_solve(Matrix& A, const std::vector<double>& b){
+    check_solvable(A, b);   //checked before allocating L and U, whose constructor rejects zero dimensions.
+
+    Matrix L(A.rows(), A.columns(), 0.0);
+    Matrix U(A.rows(), A.columns(), 0.0);
+    std::vector<size_t> pivots(b.size());
+    std::vector<double> x(b.size());
+    linear_solve_into(A, b, L, U, pivots, x);
+    return x;
+}
+
+/*
+Same as linear_solve, but uses caller-provided buffers instead of allocating.
+L and U must have the same dimensions as A and are overwritten with its decomposition.
+A, L and U must be three different objects.
+pivots is resized to the length of b and receives the row exchanges (see lu_decomp_into).
+x is resized to the length of b and receives the solution; it must not be the same object as b.
+Throws the same errors as linear_solve, and also the invalid_argument thrown by lu_decomp_into
+if L or U have the wrong dimensions or are the same object as A or as each other.
+*/
+void linear_solve_into(Matrix& A, const std::vector<double>& b, Matrix& L, Matrix& U,
+    std::vector<size_t>& pivots, std::vector<double>& x){
+    // Checked here so that every invalid_argument coming out of lu_decomp_into is a problem with L or U,
+    // which is passed on to the caller unchanged.
+    check_solvable(A, b);
     try {
-        std::pair<Matrix, Matrix> lu_pair = lu_decomp(A);
-        std::vector<double> y = linear_solve_lower(lu_pair.first, b);
-        return linear_solve_upper(lu_pair.second, y);
-    } catch (std::invalid_argument){
-        throw std::invalid_argument("linear_solve: the system is over- or underdetermined, or is empty.");
-    } catch (std::domain_error){
+        lu_decomp_into(A, L, U, pivots);
+    } catch (const std::domain_error&){
         throw std::domain_error("linear_solve: the system is unsolvable (the rows are not linear independent or the system has no solution).");
     }
-    
+    // x starts as Pb: b with the same row exchanges that were applied to A.
+    x = b;
+    for (size_t j = 0; j < pivots.size(); ++j){
+        std::swap(x[j], x[pivots[j]]);
+    }
+    // y and x share the same buffer with Pb: each solve only reads entry i of its right-hand side
+    // before overwriting entry i of its solution.
+    linear_solve_lower(L, x, x);
+    linear_solve_upper(U, x, x);
 }
@@ -8,9 +8,20 @@
 // Check for throwable conditions in linear_solve.
 
 /*
-Solves a linear system Ax = b by decomposing A = LU, then solving Ly = b, followed by Ux = y.
-Returns b.
+Solves a linear system Ax = b by decomposing PA = LU, then solving Ly = Pb, followed by Ux = y.
+Returns x. Note that A might have its rows permutated by the decomposition.
 */
-std::vector<double> linear_solve(const Matrix& A, const std::vector<double> b);
+std::vector<double> linear_solve(Matrix& A, const std::vector<double>& b);
+
+/*
+Same as linear_solve, but uses caller-provided buffers instead of allocating.
+L and U must have the same dimensions as A and are overwritten with its decomposition.
+A, L and U must be three different objects.
+pivots is resized to the length of b and receives the row exchanges (see lu_decomp_into).
+x is resized to the length of b and receives the solution; it must not be the same object as b.
+No allocation happens if pivots and x already have enough capacity.
+*/
+void linear_solve_into(Matrix& A, const std::vector<double>& b, Matrix& L, Matrix& U,
+    std::vector<size_t>& pivots, std::vector<double>& x);
 
 #endif
\ No newline at end of file
@@ -1,7 +1,44 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 #include "decomposition.h"
+#include "linear_solve.h"
 #include "matrix.h"
 
+/*
+Prints the result of a check and counts the failures.
+*/
+static int failures = 0;
+static void check(bool condition, const std::string &description) {
+	std::cout << (condition ? "PASSED: " : "FAILED: ") << description << std::endl;
+	if (!condition)
+		++failures;
+}
+
+/*
+Returns true if both matrices have the same dimensions and entries.
+*/
+static bool matrices_equal(const Matrix &lhs, const Matrix &rhs) {
+	return lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns()
+		&& std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
+/*
+Returns true if both vectors have the same length and their entries differ by less than 1e-12.
+*/
+static bool vectors_close(const std::vector<double> &lhs, const std::vector<double> &rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	for (std::vector<double>::size_type i = 0; i != lhs.size(); ++i) {
+		if (std::abs(lhs[i] - rhs[i]) > 1e-12)
+			return false;
+	}
+	return true;
+}
+
 int main() {
 	using namespace std;
 
@@ -27,6 +64,124 @@ int main() {
 	cout << "Constructed Id 3x3!" << endl;
 	cout << id_3_3 << endl;
 
+	cout << "Testing lu_decomp and lu_decomp_into on a 3x3 system." << endl;
+	const Matrix system({ { 4.0, 1.0, 0.0 }, { 1.0, 4.0, 1.0 }, { 0.0, 1.0, 4.0 } });
+
+	Matrix A1(system);
+	pair<Matrix, Matrix> lu_pair = lu_decomp(A1);
+	cout << lu_pair.first << lu_pair.second << endl;
+
+	Matrix A2(system);
+	Matrix L(3, 3, 7.0), U(3, 3, 7.0); //garbage entries, must be overwritten
+	lu_decomp_into(A2, L, U);
+	check(matrices_equal(lu_pair.first, L), "lu_decomp_into computes the same L as lu_decomp");
+	check(matrices_equal(lu_pair.second, U), "lu_decomp_into computes the same U as lu_decomp");
+
+	// L must be unit lower triangular, U upper triangular, and LU must give back A.
+	bool triangular = true, product = true;
+	for (size_t i = 0; i < 3u; ++i) {
+		for (size_t j = 0; j < 3u; ++j) {
+			if ((i < j && L(i, j) != 0.0) || (i == j && L(i, j) != 1.0) || (i > j && U(i, j) != 0.0))
+				triangular = false;
+			double entry = 0.0;
+			for (size_t k = 0; k < 3u; ++k)
+				entry += L(i, k) * U(k, j);
+			if (std::abs(entry - A2(i, j)) > 1e-12)
+				product = false;
+		}
+	}
+	check(triangular, "L is unit lower triangular and U is upper triangular");
+	check(product, "LU is equal to A");
+
+	Matrix L_small(2, 2, 0.0);
+	Matrix A3(system);
+	bool threw = false;
+	try {
+		lu_decomp_into(A3, L_small, U);
+	} catch (const invalid_argument&) {
+		threw = true;
+	}
+	check(threw, "lu_decomp_into rejects an L with the wrong dimensions");
+
+	threw = false;
+	try {
+		lu_decomp_into(A3, L, L);
+	} catch (const invalid_argument&) {
+		threw = true;
+	}
+	check(threw, "lu_decomp_into rejects L and U being the same matrix");
+
+	cout << "Testing linear_solve and linear_solve_into." << endl;
+	const vector<double> b{ 6.0, 12.0, 14.0 };	//the solution is x = (1, 2, 3)
+	const vector<double> expected{ 1.0, 2.0, 3.0 };
+
+	Matrix A4(system);
+	vector<double> x = linear_solve(A4, b);
+	check(vectors_close(x, expected), "linear_solve solves the 3x3 system");
+
+	Matrix A5(system);
+	vector<size_t> pivots;
+	vector<double> x_into;
+	linear_solve_into(A5, b, L, U, pivots, x_into);
+	check(vectors_close(x_into, expected), "linear_solve_into solves the 3x3 system");
+	check(x == x_into, "linear_solve_into gives the same solution as linear_solve");
+
+	Matrix diagonal({ { 2.0, 0.0 }, { 0.0, 4.0 } });
+	Matrix L2(2, 2, 0.0), U2(2, 2, 0.0);
+	linear_solve_into(diagonal, { 2.0, 2.0 }, L2, U2, pivots, x_into);
+	check(vectors_close(x_into, { 1.0, 0.5 }), "linear_solve_into solves a 2x2 diagonal system");
+
+	Matrix A6(system);
+	threw = false;
+	try {
+		linear_solve_into(A6, b, L_small, U, pivots, x_into);
+	} catch (const invalid_argument &error) {
+		threw = string(error.what()).find("L and U") != string::npos;
+	}
+	check(threw, "linear_solve_into reports an L with the wrong dimensions as such");
+
+	cout << "Testing systems that need row exchanges." << endl;
+	// Each system is paired with its solution; b is computed as A * solution.
+	const vector< pair<Matrix, vector<double> > > pivoted{
+		{ Matrix({ { 1.0, 2.0 }, { 3.0, 4.0 } }), { 1.0, 2.0 } },
+		{ Matrix({ { 2.0, 1.0, 1.0 }, { 4.0, 3.0, 3.0 }, { 8.0, 7.0, 9.0 } }), { 1.0, 2.0, 3.0 } },
+		{ Matrix({ { 1.0, 1.0, 0.0 }, { 1.0, 1.0, 1.0 }, { 0.0, 1.0, 1.0 } }), { 1.0, 2.0, 3.0 } }	//zero pivot without exchanges
+	};
+	for (const auto &test : pivoted) {
+		const vector<double> rhs = test.first * test.second;
+		const size_t dimension = test.first.rows();
+
+		Matrix A7(test.first);
+		check(vectors_close(linear_solve(A7, rhs), test.second), "linear_solve solves a system with row exchanges");
+
+		Matrix A8(test.first);
+		Matrix L3(dimension, dimension, 0.0), U3(dimension, dimension, 0.0);
+		linear_solve_into(A8, rhs, L3, U3, pivots, x_into);
+		check(vectors_close(x_into, test.second), "linear_solve_into solves a system with row exchanges");
+	}
+
+	Matrix negative({ { -5.0, 1.0 }, { 1.0, 1.0 } });
+	Matrix L4(2, 2, 0.0), U4(2, 2, 0.0);
+	lu_decomp_into(negative, L4, U4, pivots);
+	check(pivots[0] == 0 && U4(0, 0) == -5.0, "lu_decomp_into pivots on the entry with the largest absolute value");
+
+	Matrix singular({ { 1.0, 2.0 }, { 2.0, 4.0 } });
+	threw = false;
+	try {
+		linear_solve(singular, { 1.0, 2.0 });
+	} catch (const domain_error&) {
+		threw = true;
+	}
+	check(threw, "linear_solve rejects a singular system");
+
+	Matrix moved(std::move(singular));
+	threw = false;
+	try {
+		linear_solve(singular, {});
+	} catch (const invalid_argument &error) {
+		threw = string(error.what()).find("linear_solve") != string::npos;
+	}
+	check(threw, "linear_solve rejects an empty matrix with its own error");
 
-	return 1;
+	return failures ? 1 : 0;
 }
\ No newline at end of file
@@ -1,6 +1,28 @@
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 #include "matrix.h"
 
+/*
+Prints the result of a check and counts the failures.
+*/
+static int failures = 0;
+static void check(bool condition, const std::string &description) {
+	std::cout << (condition ? "PASSED: " : "FAILED: ") << description << std::endl;
+	if (!condition)
+		++failures;
+}
+
+/*
+Returns true if both matrices have the same dimensions and entries.
+*/
+static bool matrices_equal(const Matrix &lhs, const Matrix &rhs) {
+	return lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns()
+		&& std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
+}
+
 int main() {
 	using namespace std;
 
@@ -26,6 +48,49 @@ int main() {
 	cout << "Constructed Id 3x3!" << endl;
 	cout << id_3_3 << endl;
 
+	check(id_3_3(1, 1) == 1.0 && id_3_3(0, 1) == 0.0, "writing through the non-const operator() works");
+
+	cout << "Testing chained row operations on the Id 3x3." << endl;
+	id_3_3.exchangeRows(0, 2).multiplyRow(0, 2.0).linearCombination(3.0, 0, 1);
+	cout << id_3_3 << endl;
+	const Matrix chained({ { 0.0, 0.0, 2.0 }, { 0.0, 1.0, 6.0 }, { 1.0, 0.0, 0.0 } });
+	check(matrices_equal(id_3_3, chained), "chained exchangeRows, multiplyRow and linearCombination");
+
+	Matrix combination({ { 1.0, 2.0 }, { 3.0, 4.0 } });
+	combination.linearCombination(2.0, 0, 1);
+	check(matrices_equal(combination, Matrix({ { 1.0, 2.0 }, { 5.0, 8.0 } })), "linearCombination adds to the start of the target row");
+
+	cout << "Testing copy, move and swap." << endl;
+	Matrix copied(1, 1, 0.0);
+	copied = id_3_3;
+	check(matrices_equal(copied, chained), "copy assignment copies the entries");
+	copied(0, 0) = 5.0;
+	check(id_3_3(0, 0) == 0.0, "copy assignment makes a deep copy");
+
+	Matrix moved_3_3(std::move(id_3_3));
+	check(matrices_equal(moved_3_3, chained), "move constructor takes the entries");
+	check(id_3_3.rows() == 0 && id_3_3.columns() == 0 && id_3_3.empty(), "move constructor leaves the source empty");
+
+	Matrix move_assigned(1, 1, 0.0);
+	move_assigned = std::move(moved_3_3);
+	check(matrices_equal(move_assigned, chained), "move assignment takes the entries");
+	check(moved_3_3.rows() == 0 && moved_3_3.columns() == 0 && moved_3_3.empty(), "move assignment leaves the source empty");
+
+	Matrix small(1, 2, 9.0);
+	swap(small, move_assigned);
+	check(matrices_equal(small, chained), "swap exchanges the entries of the first matrix");
+	check(matrices_equal(move_assigned, Matrix(1, 2, 9.0)), "swap exchanges the entries of the second matrix");
+
+	cout << "Testing products with a vector." << endl;
+	const Matrix product({ { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } });
+	const vector<double> v{ 1.0, 1.0, 2.0 };
+	const vector<double> expected{ 9.0, 21.0 };
+	check(product * v == expected, "operator* multiplies a matrix by a vector");
+
+	vector<double> out{ 7.0, 7.0, 7.0, 7.0 };
+	product.multiply_into(v, out);
+	check(out == expected, "multiply_into resizes and overwrites the output vector");
+
 
-	return 1;
+	return failures ? 1 : 0;
 }
\ No newline at end of file